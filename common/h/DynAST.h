@@ -154,7 +154,8 @@ class name : public AST {						\
     if (!(t_ == other.t_)) return false;				\
     if (kids_.size() != other.kids_.size()) return false;               \
     for (unsigned i = 0; i < kids_.size(); ++i)                         \
-      if (!(kids_[i]->equals(other.kids_[i]))) return false;            \
+      if (kids_[i] != other.kids_[i] &&                                 \
+          !(kids_[i]->equals(other.kids_[i]))) return false;            \
     return true;                                                        \
   }									\
   const type t_;							\
@@ -191,6 +192,8 @@ class COMMON_EXPORT AST : public boost::enable_shared_from_this<AST> {
   virtual ~AST() {};
   
   bool operator==(const AST &rhs) const {
+    // Shared subtrees compare equal without walking them
+    if (this == &rhs) return true;
     // make sure rhs and this have the same type
     return((typeid(*this) == typeid(rhs)) && isStrictEqual(rhs));
   }
@@ -129,6 +129,17 @@ private:
    typedef std::map<std::pair<Address, std::string>, LoadedLib *, LibCmp> sorted_libs_t;
    sorted_libs_t sorted_libs;
 
+   // Names read from link_map nodes on the last complete walk, keyed by
+   // node address, so unchanged libraries cost no string reads
+   struct link_name_entry {
+      Address name_addr;
+      Address load_addr;
+      Address dynamic_addr;
+      std::string name;
+   };
+   typedef std::map<Address, link_name_entry> link_names_t;
+   link_names_t link_names;
+
    /* platform-specific functions */
    std::string getExecName();
    ProcessReader *createDefaultDebugger(int pid);
@@ -42,6 +42,7 @@
 #include "ABI.h"
 #include <map>
 #include <set>
+#include <vector>
 
 
 using namespace Dyninst;
@@ -49,13 +50,15 @@ using namespace Dyninst::InstructionAPI;
 
 struct livenessData{
 	bitArray in, out, use, def;
+	// Per-instruction read/write sets, in address order, recorded while
+	// summarizing the block so that queries need not decode it again
+	std::vector<std::pair<Address, ReadWriteInfo> > insns;
 };
 
 class DATAFLOW_EXPORT LivenessAnalyzer{
 	std::map<ParseAPI::Block*, livenessData> blockLiveInfo;
 	std::map<ParseAPI::Function*, bool> liveFuncCalculated;
         std::map<ParseAPI::Function*, bitArray> funcRegsDefined;
-	InstructionCache cachedLivenessInfo;
 
 	const bitArray& getLivenessIn(ParseAPI::Block *block);
 	const bitArray& getLivenessOut(ParseAPI::Block *block, bitArray &allRegsDefined);
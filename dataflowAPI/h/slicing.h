@@ -665,6 +665,7 @@ class Slicer {
   void markAsEntryNode(GraphPtr ret, Element &current);
 
   void getInsns(Location &loc);
+  InsnVec &blockInsns(ParseAPI::Function *func, ParseAPI::Block *block);
 
 public:
   void getInsnsBackward(Location &loc);
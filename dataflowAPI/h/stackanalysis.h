@@ -545,8 +545,8 @@ private:
       const DefHeightSet &s2);
    void meet(const AbslocState &source, AbslocState &accum);
    void meetSummary(const TransferSet &source, TransferSet &accum);
-   AbslocState getSrcOutputLocs(ParseAPI::Edge* e);
-   TransferSet getSummarySrcOutputLocs(ParseAPI::Edge *e);
+   const AbslocState &getSrcOutputLocs(ParseAPI::Edge* e);
+   const TransferSet &getSummarySrcOutputLocs(ParseAPI::Edge *e);
    void computeInsnEffects(ParseAPI::Block *block, InstructionPtr insn,
       const Offset off, TransferFuncs &xferFunc, TransferSet &funcSummary);
 
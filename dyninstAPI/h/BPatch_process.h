@@ -420,6 +420,35 @@ class BPATCH_DLL_EXPORT BPatch_process : public BPatch_addressSpace {
     
   bool  finalizeInsertionSetWithCatchup(bool atomic, bool *modified,
 					BPatch_Vector<BPatch_catchupInfo> &catchup_handles);
+
+  //  BPatch_process::setLivePatching
+  //
+  //  On x86, let finalizeInsertionSet install instrumentation while the
+  //  process keeps running, stopping threads only briefly, instead of
+  //  stopping the whole process.  Off by default.
+
+  void  setLivePatching(bool live);
+  bool  isLivePatching();
+
+  //  BPatch_process::finalizeInsertionSets
+  //
+  //  Finalize the pending insertion sets of a group of processes, such as
+  //  the ranks of a parallel job.  Code is still generated per process, but
+  //  the group is stopped, written and continued with collective
+  //  ProcControlAPI operations rather than one process at a time.
+  //  Processes using live patching are finalized individually.
+
+  static bool finalizeInsertionSets(const BPatch_Vector<BPatch_process *> &procs);
+
+  //  BPatch_process::startOneTimeCodeChannel
+  //
+  //  On Linux, start a helper thread in the runtime library that runs
+  //  oneTimeCode calls posted through shared memory, instead of hijacking
+  //  a thread with an inferior RPC.  Only snippets that are a single
+  //  function call with constant arguments use it; everything else still
+  //  goes through an inferior RPC.  Returns false if it couldn't be started.
+
+  bool startOneTimeCodeChannel();
    
     
   //  BPatch_process::oneTimeCode
@@ -53,7 +53,7 @@ namespace Dyninst {
 class MemoryEmulator {
   public:
    MemoryEmulator(AddressSpace *addrSpace)
-      : aS_(addrSpace), mutateeBase_(0) {};
+      : aS_(addrSpace), mutateeBase_(0), pageDirBase_(0) {};
    ~MemoryEmulator() {};
 
    void addAllocatedRegion(Address start, unsigned size);
@@ -100,6 +100,8 @@ class MemoryEmulator {
    MemoryMapTree reverseMemoryMap_;
 
    Address mutateeBase_;
+   // RTmemoryPageDir, the inline-probed translation table; may be absent
+   Address pageDirBase_;
 
    std::map<SymtabAPI::Region*, std::map<Address,int> > springboards_;
 
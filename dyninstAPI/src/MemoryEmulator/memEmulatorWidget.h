@@ -143,6 +143,7 @@ class MemEmulator : public Widget {
    bool push(Register);
    bool pop(Register);
    Address getTranslatorAddr(bool wantShiftFunc);
+   Address getPageDirAddr();
 
 
    /// Members
@@ -164,12 +165,15 @@ class MemEmulator : public Widget {
 
 struct MemEmulatorPatch : public Patch {
    // Put in a call to the RTtranslateMemory
-   // function
+   // function, preceded by an inline probe of the
+   // page translation table at pd (if nonzero)
    MemEmulatorPatch(Register s,
 	                Register t,
 					Address o,
-                    Address d)
-		: source_(s), target_(t), orig_(o), dest_(d) {};
+                    Address d,
+                    Address pd,
+                    bool shift)
+		: source_(s), target_(t), orig_(o), dest_(d), pageDir_(pd), shift_(shift) {};
    virtual bool apply(codeGen &gen, CodeBuffer *buf);
    virtual unsigned estimate(codeGen &) { return 7; };
    virtual ~MemEmulatorPatch() {};
@@ -178,6 +182,8 @@ struct MemEmulatorPatch : public Patch {
    Register target_;
    Address orig_;
    Address dest_;
+   Address pageDir_;
+   bool shift_;
 };
 
 };
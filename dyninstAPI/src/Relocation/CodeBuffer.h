@@ -57,6 +57,8 @@
 
 #include "common/h/dyntypes.h"
 #include <list>
+#include <map>
+#include <vector>
 #include "dyninstAPI/src/codegen.h"
 
 class codeGen;
@@ -108,6 +110,8 @@ class CodeBuffer {
       bool valid() { return type != Invalid; };
    };
 
+   typedef std::vector<std::pair<unsigned, Address> > LabelReads;
+
    class BufferElement {
       friend class CodeBuffer;
      public:
@@ -128,12 +132,23 @@ class CodeBuffer {
 
      private:
       void addTracker(TrackerElement *tracker);
+      bool applyPatch(CodeBuffer *buf, codeGen &gen);
 
       Address addr_;
       unsigned size_;
       Buffer buffer_;
       Patch *patch_;
       unsigned labelID_;
+
+      // What the patch produced in the previous iteration, and the
+      // inputs it saw (its address and the label addresses it asked
+      // for). If those haven't moved we reuse the bytes rather than
+      // re-applying the patch, so each iteration only regenerates the
+      // spans that were actually affected by the last one.
+      Buffer patchCache_;
+      Address patchAddr_;
+      LabelReads patchReads_;
+      bool patchCached_;
       // Here the Offset is an offset within the buffer, starting at 0.
       typedef std::map<Offset, TrackerElement *> Trackers;
       Trackers trackers_;
@@ -144,6 +159,14 @@ class CodeBuffer {
    ~CodeBuffer();
    
    void initialize(const codeGen &templ, unsigned numBlocks);
+
+   // Segments let a group of RelocBlocks be generated independently of
+   // (and concurrently with) the rest of the buffer. The owning buffer
+   // reserves a contiguous range of label IDs for the segment, and
+   // once the segment is filled in it is appended in order.
+   unsigned reserveLabels(unsigned num);
+   void initializeSegment(const codeGen &templ, unsigned firstLabel);
+   void append(CodeBuffer &segment);
    
    unsigned getLabel();
    unsigned defineLabel(Address addr);
@@ -170,6 +193,7 @@ class CodeBuffer {
   private:
 
    BufferElement &current();
+   bool labelsMoved(const LabelReads &reads);
 
    typedef std::list<BufferElement> Buffers;
    Buffers buffers_;
@@ -185,6 +209,15 @@ class CodeBuffer {
 
    Labels labels_;
    int curLabelID_;
+   // Non-zero for segments; labels_ is indexed relative to this.
+   unsigned labelBase_;
+
+   // Labels for fixed addresses, so that patches asking for the same
+   // target every iteration don't keep allocating new ones.
+   std::map<Address, unsigned> absLabels_;
+
+   // Where predictedAddr records lookups while a patch is applied.
+   LabelReads *labelReads_;
 
    int shift_;
 
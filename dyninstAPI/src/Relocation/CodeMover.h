@@ -137,6 +137,8 @@ class CodeMover {
 
   void finalizeRelocBlocks();
 
+  bool generateParallel(const codeGen &genTemplate, unsigned numThreads);
+
   RelocGraph *cfg_;
 
   Address addr_;
@@ -158,6 +158,9 @@ class AddressSpace : public InstructionSource {
     virtual bool writeTextSpace(void *inOther,
                                 u_int amount,
                                 const void *inSelf) = 0;
+    // Writes the jumps patchCode generated over original code; the default
+    // is a plain writeTextSpace of each one
+    virtual bool writeSpringboards(std::list<codeGen> &patches);
 
     Address getTOCoffsetInfo(func_instance *);
 
@@ -687,6 +687,10 @@ class AstCallNode : public AstNode {
  
     void setConstFunc(bool val) { constFunc_ = val; }
 
+    // If the callee and every argument are known without generating
+    // code, fill in the callee's address and the argument values
+    bool getConstantCall(AddressSpace *as, Address &target, pdvector<Address> &args) const;
+
     virtual bool initRegisters(codeGen &gen);
 
  private:
@@ -219,6 +219,18 @@ class BinaryEdit : public AddressSpace {
     
     codeRangeTree* memoryTracker_;
 
+    // Flat page-indexed front for memoryTracker_: entry i names the tracker
+    // that fully covers page (pageIndexBase_ + i), or NULL if no single
+    // tracker does and the tree has to be consulted.
+    static const unsigned PageIndexShift = 12;
+    static const Address MaxIndexedPages = 1 << 20;
+    std::vector<memoryTracker *> pageIndex_;
+    Address pageIndexBase_;
+    void insertTracker(memoryTracker *tracker);
+    void removeTracker(memoryTracker *tracker);
+    void indexTracker(memoryTracker *tracker, bool add);
+    memoryTracker *findTracker(Address addr);
+
     mapped_object * addSharedObject(const std::string *fullPath);
 
     std::vector<depRelocation *> dependentRelocations;
@@ -251,16 +263,17 @@ class depRelocation {
 class memoryTracker : public codeRange {
  public:
     memoryTracker(Address a, unsigned s) :
-        alloced(false),  dirty(false), a_(a), s_(s) {
+        alloced(false),  dirty(false), a_(a), s_(s), orig_(NULL) {
         b_ = malloc(s_);
     }
 
+    // Backing store for an original section; the section contents are
+    // only copied once something writes to them.
     memoryTracker(Address a, unsigned s, void *b) :
-    alloced(false), dirty(false), a_(a), s_(s)
+    alloced(false), dirty(false), a_(a), s_(s), orig_(b)
         {
             if(b) {
-                b_ = malloc(s_);
-                memcpy(b_, b, s_);
+                b_ = NULL;
             } else {
                 b_ = calloc(1, s_);
             }
@@ -269,8 +282,16 @@ class memoryTracker : public codeRange {
 
     Address get_address() const { return a_; }
     unsigned get_size() const { return s_; }
-    void *get_local_ptr() const { return b_; }
+    void *get_local_ptr() const { return b_ ? b_ : orig_; }
+    void *get_writable_ptr() {
+      if (!b_) {
+        b_ = malloc(s_);
+        memcpy(b_, orig_, s_);
+      }
+      return b_;
+    }
     void realloc(unsigned newsize) {
+      get_writable_ptr();
       b_ = ::realloc(b_, newsize);
       s_ = newsize;
       if (!b_ && newsize) {
@@ -286,7 +307,7 @@ class memoryTracker : public codeRange {
     Address a_;
     unsigned s_;
     void *b_;
-    
+    void *orig_;
 };
 
 #endif // BINARY_H
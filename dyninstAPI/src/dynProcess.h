@@ -108,6 +108,11 @@ public:
     bool terminateProcess();
     bool detachProcess(bool cont);
 
+    // The same for a group of processes, as one collective ProcControlAPI
+    // operation
+    static bool stopProcesses(const std::vector<PCProcess *> &procs);
+    static bool continueProcesses(const std::vector<PCProcess *> &procs);
+
     // Process status
     bool isBootstrapped() const; // true if Dyninst has finished it's initialization for the process
     bool isAttached() const; // true if ok to operate on the process
@@ -138,6 +143,14 @@ public:
 
     unsigned getMemoryPageSize() const;
 
+    // Between beginWriteBatch and endWriteBatch, writes are journaled and
+    // issued as coalesced ranges by flushWriteBatch
+    void beginWriteBatch();
+    bool flushWriteBatch();
+    bool endWriteBatch();
+    // Flush the journals of several processes with a single write
+    static bool flushWriteBatches(const std::vector<PCProcess *> &procs);
+
     typedef ProcControlAPI::Process::mem_perm PCMemPerm;
     bool getMemoryAccessRights(Address start,  PCMemPerm& rights);
     bool setMemoryAccessRights(Address start,  size_t size, PCMemPerm  rights);
@@ -180,6 +193,15 @@ public:
     Address getTOCoffsetInfo(func_instance *func); // platform-specific
     bool getOPDFunctionAddr(Address &opdAddr); // architecture-specific
 
+    // Live springboard installation (x86 only): between beginLivePatch and
+    // endLivePatch, springboards are written while the other threads run
+    void setLivePatching(bool live);
+    bool isLivePatching() const;
+    bool beginLivePatch();
+    void endLivePatch();
+    bool isLivePatchTrap(ProcControlAPI::Thread::const_ptr thr, bool &hold);
+    virtual bool writeSpringboards(std::list<codeGen> &patches);
+
     // iRPC interface
     bool postIRPC(AstNodePtr action,
                  void *userData,
@@ -200,6 +222,15 @@ public:
 		bool userRPC, 
 		bool isMemAlloc = false, 
 		Address addr = 0);
+
+    // Shared-memory call channel to a helper thread in the runtime library.
+    // Once started, a call with constant arguments can be run through it
+    // instead of an iRPC.  postIRPCChannelCall returns false if the channel
+    // can't take the call; otherwise err reports whether the call finished.
+    bool startIRPCChannel();
+    bool hasIRPCChannel() const;
+    bool postIRPCChannelCall(AstNodePtr action, void **result, bool &err);
+    void stopIRPCChannel();
 private:
         bool postIRPC_internal(void *buffer,
                                unsigned size,
@@ -365,7 +396,14 @@ protected:
           isInDebugSuicide_(false),
           irpcTramp_(NULL),
           inEventHandling_(false),
-          stackwalker_(NULL)
+          stackwalker_(NULL),
+          livePatching_(false),
+          livePatchAnchorStopped_(false),
+          livePatchStoppedAll_(false),
+          writeBatching_(false),
+          irpcChannel_(NULL),
+          irpcChannelNext_(0),
+          irpcChannelHelper_(NULL_LWP)
     {
         irpcTramp_ = baseTramp::createForIRPC(this);
     }
@@ -405,7 +443,14 @@ protected:
           isInDebugSuicide_(false),
           irpcTramp_(NULL),
           inEventHandling_(false),
-          stackwalker_(NULL)
+          stackwalker_(NULL),
+          livePatching_(false),
+          livePatchAnchorStopped_(false),
+          livePatchStoppedAll_(false),
+          writeBatching_(false),
+          irpcChannel_(NULL),
+          irpcChannelNext_(0),
+          irpcChannelHelper_(NULL_LWP)
     {
         irpcTramp_ = baseTramp::createForIRPC(this);
     }
@@ -447,7 +492,14 @@ protected:
           mt_cache_result_(parent->mt_cache_result_),
           isInDebugSuicide_(parent->isInDebugSuicide_),
           inEventHandling_(false),
-          stackwalker_(NULL)
+          stackwalker_(NULL),
+          livePatching_(false),
+          livePatchAnchorStopped_(false),
+          livePatchStoppedAll_(false),
+          writeBatching_(false),
+          irpcChannel_(NULL),
+          irpcChannelNext_(0),
+          irpcChannelHelper_(NULL_LWP)
     {
         irpcTramp_ = baseTramp::createForIRPC(this);
     }
@@ -616,6 +668,30 @@ protected:
     Dyninst::Stackwalker::Walker *stackwalker_;
     static Dyninst::SymtabAPI::SymtabReaderFactory *symReaderFactory_;
     std::map<Address, ProcControlAPI::Breakpoint::ptr> installedCtrlBrkpts;
+
+    // Live springboard installation
+    bool syncLivePatchThreads(const std::map<Address, Address> *ranges);
+    bool writeLiveSpringboards(std::list<codeGen> &patches);
+    bool livePatching_;
+    ProcControlAPI::Thread::ptr livePatchAnchor_; // kept stopped for memory operations
+    bool livePatchAnchorStopped_; // true if we stopped the anchor ourselves
+    bool livePatchStoppedAll_; // fell back to stopping the whole process
+    std::map<Address, bool> livePatchHeads_; // int3'd springboard start -> complete
+    std::set<Dyninst::LWP> livePatchHeld_; // threads rewound onto an int3 and held
+
+    // Write batching
+    bool journalWrite(Address addr, u_int amount, const void *inSelf);
+    bool journalOverlaps(Address addr, u_int amount) const;
+    bool writeBatching_;
+    std::map<Address, std::string> writeJournal_; // disjoint, non-adjacent ranges
+
+    // iRPC channel; the mapping and waiting are platform-specific
+    bool mapIRPCChannel();
+    void unmapIRPCChannel();
+    bool waitIRPCChannelSlot(irpcChannelSlot_t *slot);
+    irpcChannel_t *irpcChannel_;
+    unsigned irpcChannelNext_;
+    Dyninst::LWP irpcChannelHelper_;
 };
 
 class inferiorRPCinProgress : public codeRange {
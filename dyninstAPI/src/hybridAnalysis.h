@@ -375,8 +375,10 @@ private:
     // remove any coverage instrumentation
     // make a shadow page, 
     // restore write privileges to the page, 
+    // and do the same for up to aheadPages following pages of analyzed code
     void makeShadow_setRights(Dyninst::Address pageAddr,
-                              owLoop *loop);
+                              owLoop *loop,
+                              unsigned aheadPages = 0);
 
     bool isRealStore(Dyninst::Address insnAddr, 
                      block_instance *blk, 
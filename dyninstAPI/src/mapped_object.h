@@ -250,6 +250,7 @@ class mapped_object : public codeRange, public Dyninst::PatchAPI::DynObject {
     void setCodeBytesUpdated(bool);
     void addProtectedPage(Address pageAddr); // adds to protPages_
     void removeProtectedPage(Address pageAddr);
+    bool isProtectedPage(Address pageAddr) const;
     void removeEmptyPages();
     void remove(func_instance *func);
     void remove(instPoint *p);
@@ -84,7 +84,9 @@ extern int DYNINSTdebugPrintRT; /* control run-time lib debug/trace prints */
 #define RTprintf                if (DYNINSTdebugPrintRT) printf
 #endif
 
-#define TARGET_CACHE_WIDTH 128
+/* DYNINST_target_cache is probed inline by instrumentation, which masks
+   with TARGET_CACHE_WIDTH - 1, so it must stay a power of two */
+#define TARGET_CACHE_WIDTH 1024
 #define TARGET_CACHE_WAYS 2
 
 #define THREAD_AWAITING_DELETION -2
@@ -181,6 +183,18 @@ struct trap_mapping_header {
 
 #define MAX_MEMORY_MAPPER_ELEMENTS 1024
 
+/* Two-level page translation table probed inline by the memory emulation
+ * widgets.  The directory is indexed by the top 10 bits of a 32-bit address
+ * and each table by the next 10; an entry holds the shift for the whole page,
+ * or MEMORY_PAGE_SLOW if the page needs the full RTtranslateMemory lookup.
+ * A null directory entry also means "take the slow path". */
+#define MEMORY_PAGE_SHIFT 12
+#define MEMORY_PAGE_DIR_SHIFT 22
+#define MEMORY_PAGE_DIR_SIZE 1024
+#define MEMORY_PAGE_TABLE_SIZE 1024
+#define MEMORY_PAGE_TABLE_POOL 64
+#define MEMORY_PAGE_SLOW ((int32_t) 0x80000001)
+
 typedef struct {
     long start;
     long size;
@@ -237,5 +251,33 @@ DLLEXPORT extern struct MemoryMapper RTmemoryMapper;
 
 extern int RTuntranslatedEntryCounter;
 
+/* Shared-memory call channel (Linux).  DYNINST_irpcChannelStart creates
+ * IRPC_CHANNEL_NAME and a helper thread that runs the calls the mutator
+ * posts to its slots.  All fields are fixed width and 8-byte aligned so
+ * 32- and 64-bit mutators see the same layout. */
+#define IRPC_CHANNEL_NAME "/dev/shm/dyninst-irpc-%d"
+#define IRPC_CHANNEL_MAGIC 0x44495243
+#define IRPC_CHANNEL_SLOTS 64
+#define IRPC_CHANNEL_MAX_ARGS 6
+
+#define IRPC_SLOT_FREE 0
+#define IRPC_SLOT_POSTED 1
+#define IRPC_SLOT_DONE 2
+
+typedef struct {
+   volatile uint32_t state;
+   uint32_t nargs;
+   uint64_t func;
+   uint64_t args[IRPC_CHANNEL_MAX_ARGS];
+   uint64_t result;
+} irpcChannelSlot_t;
+
+typedef struct {
+   uint32_t magic;
+   volatile uint32_t shutdown;
+   volatile uint64_t helper_lwp;
+   irpcChannelSlot_t slots[IRPC_CHANNEL_SLOTS];
+} irpcChannel_t;
+
 #include "dyninstRTExport.h"
 #endif /* _DYNINSTAPI_RT_H */
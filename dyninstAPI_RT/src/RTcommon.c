@@ -390,14 +390,16 @@ DLLEXPORT void DYNINST_instLwpExit(void) {
 
 
 // implementation of an N=2 way associative cache to keep access time low
-// width = 32
+// width = TARGET_CACHE_WIDTH; instrumentation probes it inline and only
+// calls in here on a miss, so keep the indexing in sync with
+// targetCacheMissNode in BPatch_snippet.C
 // the cache contains valid addresses
 // add to the cache when an instrumented instruction misses in the cache
 // update flags for the cache when an instrumented instruction hits in the cache
 // instrumentation will take the form of a call to cache check
 RT_Boolean cacheLookup(void *calculation)
 {
-    int index = ((unsigned long) calculation) % TARGET_CACHE_WIDTH;
+    int index = ((unsigned long) calculation) & (TARGET_CACHE_WIDTH - 1);
     if (DYNINST_target_cache[index][0] == calculation) {
         cacheLRUflags[index] = 0;
         return RT_TRUE;
@@ -51,6 +51,7 @@
 #include <errno.h>
 #include <signal.h>
 #include <sys/mman.h>
+#include <fcntl.h>
 #include <link.h>
 
 #if defined(DYNINST_RT_STATIC_LIB)
@@ -680,6 +681,124 @@ static unsigned get_next_set_bitmask(unsigned *bit_mask, int last_pos) {
 
 #endif /* cap_mutatee_traps */
 
+/* Shared-memory call channel
+ *
+ * The mutator starts this with one ordinary iRPC to
+ * DYNINST_irpcChannelStart.  From then on it posts calls (a function
+ * address and up to IRPC_CHANNEL_MAX_ARGS integer arguments) to the slots
+ * of a ring in shared memory, and a helper thread started here runs them
+ * and writes back the result.  No ptrace stop is involved.  The helper
+ * spins briefly after each call and then backs off to short sleeps.
+ */
+#if defined(DYNINST_RT_STATIC_LIB)
+extern int pthread_create(pthread_t *, const pthread_attr_t *, void *(*)(void *), void *);
+extern int pthread_detach(pthread_t);
+#endif
+#pragma weak pthread_create
+#pragma weak pthread_detach
+
+#define IRPC_CHANNEL_SPINS 4096
+#define IRPC_CHANNEL_SLEEP_US 50
+
+typedef unsigned long (*irpcChannelFunc_t)(unsigned long, unsigned long,
+                                           unsigned long, unsigned long,
+                                           unsigned long, unsigned long);
+
+static irpcChannel_t *DYNINST_irpcChannel = NULL;
+static int DYNINST_irpcChannelPid = 0;
+
+static void *DYNINST_irpcChannelLoop(void *arg)
+{
+   irpcChannel_t *chan = (irpcChannel_t *) arg;
+   unsigned idle = 0;
+   unsigned i;
+
+   chan->helper_lwp = (uint64_t) syscall(SYS_gettid);
+
+   while (!chan->shutdown) {
+      int ran = 0;
+      for (i = 0; i < IRPC_CHANNEL_SLOTS; i++) {
+         irpcChannelSlot_t *slot = &chan->slots[i];
+         irpcChannelFunc_t func;
+         unsigned long args[IRPC_CHANNEL_MAX_ARGS];
+         unsigned j;
+
+         if (slot->state != IRPC_SLOT_POSTED) continue;
+         __sync_synchronize();
+
+         memset(args, 0, sizeof(args));
+         for (j = 0; j < slot->nargs && j < IRPC_CHANNEL_MAX_ARGS; j++)
+            args[j] = (unsigned long) slot->args[j];
+         func = (irpcChannelFunc_t) (unsigned long) slot->func;
+         slot->result = (uint64_t) func(args[0], args[1], args[2],
+                                        args[3], args[4], args[5]);
+
+         __sync_synchronize();
+         slot->state = IRPC_SLOT_DONE;
+         ran = 1;
+      }
+
+      if (ran)
+         idle = 0;
+      else if (idle < IRPC_CHANNEL_SPINS)
+         idle++;
+      else
+         usleep(IRPC_CHANNEL_SLEEP_US);
+   }
+
+   /* The mutator has let go of the channel; a later start makes a new one */
+   if (DYNINST_irpcChannel == chan)
+      DYNINST_irpcChannel = NULL;
+   munmap(chan, sizeof(irpcChannel_t));
+   return NULL;
+}
+
+DLLEXPORT int DYNINST_irpcChannelStart(void)
+{
+   char name[64];
+   irpcChannel_t *chan;
+   pthread_t helper;
+   int fd;
+
+   /* A forked child shares the parent's mapping but not its helper */
+   if (DYNINST_irpcChannel && DYNINST_irpcChannelPid == getpid())
+      return 1;
+   if (!pthread_create)
+      return 0;
+
+   snprintf(name, sizeof(name), IRPC_CHANNEL_NAME, getpid());
+   unlink(name);
+   fd = open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+   if (fd == -1)
+      return 0;
+   if (ftruncate(fd, sizeof(irpcChannel_t)) == -1) {
+      close(fd);
+      unlink(name);
+      return 0;
+   }
+   chan = (irpcChannel_t *) mmap(NULL, sizeof(irpcChannel_t), PROT_READ | PROT_WRITE,
+                                 MAP_SHARED, fd, 0);
+   close(fd);
+   if (chan == (irpcChannel_t *) MAP_FAILED) {
+      unlink(name);
+      return 0;
+   }
+   memset(chan, 0, sizeof(irpcChannel_t));
+   chan->magic = IRPC_CHANNEL_MAGIC;
+
+   if (pthread_create(&helper, NULL, DYNINST_irpcChannelLoop, chan) != 0) {
+      munmap(chan, sizeof(irpcChannel_t));
+      unlink(name);
+      return 0;
+   }
+   if (pthread_detach)
+      pthread_detach(helper);
+
+   DYNINST_irpcChannel = chan;
+   DYNINST_irpcChannelPid = getpid();
+   return 1;
+}
+
 #if defined(cap_binary_rewriter) && !defined(DYNINST_RT_STATIC_LIB)
 /* For a static binary, all global constructors are combined in an undefined
  * order. Also, DYNINSTBaseInit must be run after all global constructors have
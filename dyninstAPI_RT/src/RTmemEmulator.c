@@ -56,6 +56,104 @@ extern FILE *stOut;
 
 //#define DEBUG_MEM_EM
 
+/* Page translation table probed inline by the memory emulation widgets
+ * before they fall back to calling RTtranslateMemory(Shift).  It is built
+ * lazily from RTmemoryMapper by the slow path; the mutator clears
+ * RTmemoryPageDir whenever it rewrites the mapper, which sends every
+ * probe back here until the table has been rebuilt. */
+int32_t *RTmemoryPageDir[MEMORY_PAGE_DIR_SIZE];
+static int32_t RTmemoryPageIdentity[MEMORY_PAGE_TABLE_SIZE];
+static int32_t RTmemoryPageSlow[MEMORY_PAGE_TABLE_SIZE];
+static int32_t RTmemoryPageTables[MEMORY_PAGE_TABLE_POOL][MEMORY_PAGE_TABLE_SIZE];
+static int32_t *RTmemoryPageStaging[MEMORY_PAGE_DIR_SIZE];
+static volatile int RTmemoryPageGeneration = -1;
+DECLARE_TC_LOCK(RTmemoryPageLock);
+
+static void RTbuildPageTable(int generation)
+{
+   int i;
+   int used = 0;
+   unsigned long page, first, last, dir;
+   int32_t *table;
+   int32_t value;
+
+   for (i = 0; i < MEMORY_PAGE_DIR_SIZE; i++) {
+      RTmemoryPageDir[i] = NULL;
+      RTmemoryPageStaging[i] = NULL;
+   }
+   if (RTmemoryPageSlow[0] != MEMORY_PAGE_SLOW) {
+      for (i = 0; i < MEMORY_PAGE_TABLE_SIZE; i++)
+         RTmemoryPageSlow[i] = MEMORY_PAGE_SLOW;
+   }
+
+   for (i = 0; i < RTmemoryMapper.size && i < MAX_MEMORY_MAPPER_ELEMENTS; i++) {
+      unsigned long lo = RTmemoryMapper.elements[i].lo;
+      unsigned long hi = RTmemoryMapper.elements[i].hi;
+      long shift = RTmemoryMapper.elements[i].shift;
+      if (hi <= lo) continue;
+
+      first = lo >> MEMORY_PAGE_SHIFT;
+      last = (hi - 1) >> MEMORY_PAGE_SHIFT;
+      for (page = first; page <= last; page++) {
+         dir = page >> (MEMORY_PAGE_DIR_SHIFT - MEMORY_PAGE_SHIFT);
+         if (dir >= MEMORY_PAGE_DIR_SIZE) break; /* beyond the low 4GB */
+
+         table = RTmemoryPageStaging[dir];
+         if (!table) {
+            if (used < MEMORY_PAGE_TABLE_POOL) {
+               table = RTmemoryPageTables[used++];
+               memset(table, 0, sizeof(RTmemoryPageTables[0]));
+            }
+            else {
+               /* Out of tables; the whole 4MB chunk takes the slow path */
+               table = RTmemoryPageSlow;
+            }
+            RTmemoryPageStaging[dir] = table;
+         }
+         if (table == RTmemoryPageSlow) continue;
+
+         /* Only pages wholly inside one region get a direct shift; pages
+          * split between regions, or mapped to nothing, use the search. */
+         value = MEMORY_PAGE_SLOW;
+         if ((page << MEMORY_PAGE_SHIFT) >= lo &&
+             (page << MEMORY_PAGE_SHIFT) + ((1 << MEMORY_PAGE_SHIFT) - 1) < hi &&
+             shift != -1 &&
+             shift == (long) (int32_t) shift) {
+            value = (int32_t) shift;
+         }
+         table[page & (MEMORY_PAGE_TABLE_SIZE - 1)] = value;
+      }
+   }
+
+   /* The mapper changed underneath us; try again on a later call */
+   if (RTmemoryMapper.guard1 != generation) return;
+
+   for (i = 0; i < MEMORY_PAGE_DIR_SIZE; i++) {
+      RTmemoryPageDir[i] = RTmemoryPageStaging[i] ? RTmemoryPageStaging[i]
+                                                  : RTmemoryPageIdentity;
+   }
+
+   if (RTmemoryMapper.guard1 != generation) {
+      for (i = 0; i < MEMORY_PAGE_DIR_SIZE; i++)
+         RTmemoryPageDir[i] = NULL;
+      return;
+   }
+   RTmemoryPageGeneration = generation;
+}
+
+static void RTcheckPageTable(void)
+{
+   int generation = RTmemoryMapper.guard2;
+   if (generation == RTmemoryPageGeneration) return;
+   /* Mid-update; leave the table alone until the mutator is done */
+   if (generation != RTmemoryMapper.guard1) return;
+
+   if (tc_lock_lock(&RTmemoryPageLock) == DYNINST_DEAD_LOCK) return;
+   if (generation != RTmemoryPageGeneration)
+      RTbuildPageTable(generation);
+   tc_lock_unlock(&RTmemoryPageLock);
+}
+
 unsigned long RTtranslateMemory(unsigned long input, unsigned long origAddr, unsigned long currAddr) {
    /* Standard nonblocking synchronization construct */
    int index;
@@ -65,6 +163,8 @@ unsigned long RTtranslateMemory(unsigned long input, unsigned long origAddr, uns
    (void)origAddr; /* unused parameter */
    (void)currAddr; /* unused parameter */
 
+   RTcheckPageTable();
+
    do {
       guard2 = RTmemoryMapper.guard2;
       min = 0;
@@ -110,6 +210,8 @@ unsigned long RTtranslateMemoryShift(unsigned long input, unsigned long origAddr
    (void)origAddr; /* unused parameter */
    (void)currAddr; /* unused parameter */
 
+   RTcheckPageTable();
+
    do {
       guard2 = RTmemoryMapper.guard2;
       min = 0;
@@ -643,6 +643,10 @@ class PARSER_EXPORT Function : public allocatable, public AnnotatableSparse {
     /** same as previous two fields, but for postdominator tree */
     mutable std::map<Block*, std::set<Block*>*> immediatePostDominates;
     mutable std::map<Block*, Block*> immediatePostDominator;
+    /** pre/post order numbers of each block in the (post)dominator
+        tree; A dominates B iff A's interval encloses B's */
+    mutable std::map<Block*, std::pair<int, int> > domTreeInterval;
+    mutable std::map<Block*, std::pair<int, int> > postDomTreeInterval;
 
     /*** Internal parsing methods and state ***/
     void add_block(Block *b);
@@ -148,6 +148,14 @@ class CodeObject {
      */
     PARSER_EXPORT void finalize();
 
+    /*
+     * Computes dominator, post-dominator, and loop nesting
+     * information for every function in one pass, so that later
+     * Function::getLoops(), getLoopTree(), dominates(), etc.
+     * queries are answered from the stored results.
+     */
+    PARSER_EXPORT void analyzeLoops();
+
     /*
      * Deletion support
      */
@@ -8,14 +8,38 @@
 #include "BoundFactCalculator.h"
 using namespace Dyninst;
 
+// Memoized indirect jump analysis results for one function. This is kept
+// as an annotation on the Function, so repeated analyses of the function's
+// jumps (several jump tables in one function, or the same function parsed
+// again) can reuse earlier work.
+struct IndirectAnalysisCache {
+    // Thunk calls found in a block, keyed by the block's [start, end)
+    typedef std::vector<std::pair<Address, ThunkInfo> > BlockThunks;
+    std::map<std::pair<Address, Address>, BlockThunks> blockThunks;
+
+    // The outcome of analyzing one indirect jump. The result only depends
+    // on the blocks that can reach the jump, so it is reused while that
+    // part of the CFG has the same shape.
+    struct JumpResult {
+        std::vector<Address> shape;
+        bool resolved;
+        std::vector<std::pair<Address, Dyninst::ParseAPI::EdgeTypeEnum> > edges;
+    };
+    std::map<Address, JumpResult> jumps;
+};
+
 class IndirectControlFlowAnalyzer {
     // The function and block that contain the indirect jump
     ParseAPI::Function *func;
     ParseAPI::Block *block;
     set<ParseAPI::Block*> reachable;
     ThunkData thunks;
+    IndirectAnalysisCache *cache;
 
     void GetAllReachableBlock();  
+    void GetReachableShape(std::vector<Address> &shape);
+    IndirectAnalysisCache *GetCache();
+    bool AnalyzeJumpTable(std::vector<std::pair< Address, Dyninst::ParseAPI::EdgeTypeEnum > >& outEdges);
     void FindAllThunks();
     void ReadTable(AST::Ptr, 
                    AbsRegion, 
@@ -28,7 +52,7 @@ class IndirectControlFlowAnalyzer {
 
 public:
     bool NewJumpTableAnalysis(std::vector<std::pair< Address, Dyninst::ParseAPI::EdgeTypeEnum > >& outEdges);
-    IndirectControlFlowAnalyzer(ParseAPI::Function *f, ParseAPI::Block *b): func(f), block(b) {}
+    IndirectControlFlowAnalyzer(ParseAPI::Function *f, ParseAPI::Block *b): func(f), block(b), cache(NULL) {}
 
 };
 
@@ -33,6 +33,8 @@
 
 #include <string>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include "Annotatable.h"
 #include "CFG.h"
 
@@ -52,12 +54,12 @@ class LoopAnalyzer {
  
   
   const Function *func;
-  std::map<Block*, set<Block*> > loop_tree;
-  std::map<Block*, Loop*> loops;
+  std::unordered_map<Block*, set<Block*> > loop_tree;
+  std::unordered_map<Block*, Loop*> loops;
 
-  std::map<Block*, Block*> header;  
-  std::map<Block*, int> DFSP_pos;
-  std::set<Block*> visited;
+  std::unordered_map<Block*, Block*> header;  
+  std::unordered_map<Block*, int> DFSP_pos;
+  std::unordered_set<Block*> visited;
 
   Block* WMZC_DFS(Block* b0, int pos);
   void WMZC_TagHead(Block* b, Block* h);
@@ -174,6 +174,14 @@ class ProbabilityCalculator {
     typedef dyn_hash_map<Address, DecodeData > DecodeCache;
     DecodeCache decodeCache;
 
+    // The instructions that end exactly at an address, nearest first;
+    // backward idiom matching visits the same address once per prefix
+    // tree node, so the up-to-15 candidate decodes are done only once
+    typedef std::vector<std::pair<Address, DecodeData> > PredecessorList;
+    typedef dyn_hash_map<Address, PredecessorList> PredecessorCache;
+    PredecessorCache predecessorCache;
+    const PredecessorList & decodePredecessors(Address addr);
+
     // Recursively mathcing normal idioms and calculate weights
     double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid);
     // Recursively mathcing prefix idioms and calculate weights
@@ -132,6 +132,11 @@ class PC_EXPORT Breakpoint
 
    void setSuppressCallbacks(bool);
    bool suppressCallbacks() const;
+
+   //For execute-only hardware breakpoints: install a software breakpoint
+   // instead of failing when the debug registers are exhausted.
+   void setSoftwareFallback(bool);
+   bool softwareFallback() const;
 };
 
 class PC_EXPORT Library
@@ -343,7 +343,8 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
     * - Use the read_t/write_t forms to read/write from different memory locations/sizes in each process
     * - The AddressSet forms of readMemory need to have their memory free'd by the user.
     * - The readMemory form that outputs 'std::map<void *, ProcessSet::ptr> &result' groups processes 
-    *   based on having the same memory contents.
+    *   based on having the same memory contents.  Results are grouped as reads complete,
+    *   so only one buffer per distinct content is kept.
     **/
    struct write_t {
       void *buffer;
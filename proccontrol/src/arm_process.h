@@ -47,6 +47,8 @@ class arm_process : virtual public int_process
   virtual unsigned plat_breakpointSize();
   virtual void plat_breakpointBytes(unsigned char *buffer);
   virtual bool plat_breakpointAdvancesPC() const;
+  virtual bool plat_emulateBreakpointInsn(const unsigned char *orig, unsigned size,
+                                          Dyninst::Address addr, Dyninst::Address &next_pc);
 
   virtual bool plat_convertToBreakpointAddress(Address &addr, int_thread *thr);
 
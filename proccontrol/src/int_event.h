@@ -70,6 +70,9 @@ class int_eventBreakpointClear
    bool cached_bp_sets;
    bool set_singlestep;
    bool stopped_proc;
+   bool emulate_step;
+   Dyninst::Address emulated_pc;
+   result_response::ptr pc_regset;
 
    std::set<Thread::ptr> clearing_threads;
 };
@@ -398,6 +398,11 @@ class int_process
    virtual unsigned plat_breakpointSize() = 0;
    virtual void plat_breakpointBytes(unsigned char *buffer) = 0;
    virtual bool plat_breakpointAdvancesPC() const = 0;
+   //If the instruction displaced by a breakpoint (orig, size bytes at addr) does
+   // nothing but move the PC, return true and its next PC so threads can step
+   // past it without the breakpoint being lifted from memory.
+   virtual bool plat_emulateBreakpointInsn(const unsigned char *, unsigned, Dyninst::Address,
+                                           Dyninst::Address &) { return false; }
 
    virtual bool plat_createDeallocationSnippet(Dyninst::Address addr, unsigned long size, void* &buffer,
                                                unsigned long &buffer_size, unsigned long &start_offset) = 0;
@@ -1308,6 +1313,7 @@ class int_breakpoint
    bool procstopper;
    bool suppress_callbacks;
    bool offset_transfer;
+   bool sw_fallback;
    std::set<Thread::const_ptr> thread_specific;
  public:
    int_breakpoint(Breakpoint::ptr up);
@@ -1338,6 +1344,8 @@ class int_breakpoint
    bool isHW() const;
    unsigned getHWSize() const;
    unsigned getHWPerms() const;
+   void setSoftwareFallback(bool b);
+   bool softwareFallback() const;
 
    bool isOffsetTransfer() const;
    Breakpoint::weak_ptr upBreakpoint() const;
@@ -1429,6 +1437,7 @@ class sw_breakpoint : public bp_instance
 
    unsigned getNumIntBreakpoints() const;
    virtual bool needsClear();
+   bool getEmulatedStep(int_process *proc, Dyninst::Address &next_pc);
 };
 
 class hw_breakpoint : public bp_instance {
@@ -67,6 +67,7 @@ class GeneratorLinux : public GeneratorMT
    virtual bool initialize();
    virtual bool canFastHandle();
    virtual ArchEvent *getEvent(bool block);
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
    void evictFromWaitpid();
 };
 
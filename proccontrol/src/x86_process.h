@@ -46,6 +46,8 @@ class x86_process : virtual public int_process
   virtual unsigned plat_breakpointSize();
   virtual void plat_breakpointBytes(unsigned char *buffer);
   virtual bool plat_breakpointAdvancesPC() const;
+  virtual bool plat_emulateBreakpointInsn(const unsigned char *orig, unsigned size,
+                                          Dyninst::Address addr, Dyninst::Address &next_pc);
   virtual Address plat_findFreeMemory(size_t) { return 0; }
 };
 
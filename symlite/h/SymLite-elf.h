@@ -42,6 +42,13 @@ struct SYMLITE_EXPORT SymCacheEntry {
    const char *demangled_name;
 };
 
+struct SYMLITE_EXPORT SymNameEntry {
+   const char *name;
+   void *scn;
+   unsigned idx;
+   unsigned hash;
+};
+
 class SYMLITE_EXPORT SymElf : public Dyninst::SymReader
 {
    friend class SymElfFactory;
@@ -67,6 +74,23 @@ class SYMLITE_EXPORT SymElf : public Dyninst::SymReader
    
    void createSymCache();
    Symbol_t lookupCachedSymbol(Dyninst::Offset offset);
+
+   //Name lookup: the .dynsym is searched through its own .gnu.hash or
+   // .hash table; the remaining symbol tables through name_index, an
+   // open-addressed table built on first use.
+   bool dynhash_checked;
+   Elf_X_Shdr *dynsym_shdr;
+   Elf_X_Shdr *dynhash_shdr;
+   bool dynhash_gnu;
+
+   SymNameEntry *name_index;
+   unsigned name_index_size;
+   bool name_index_built;
+
+   void findDynSymHash();
+   void createSymNameIndex();
+   bool lookupHashedDynSym(const char *name, Symbol_t &ret);
+   bool lookupIndexedSymbol(const char *name, Symbol_t &ret);
    
    void init();
    unsigned long getSymOffset(const Elf_X_Sym &symbol, unsigned idx);   
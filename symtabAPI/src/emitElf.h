@@ -220,6 +220,7 @@ namespace Dyninst {
             unsigned loadSecTotalSize;
 
             bool isStripped;
+            bool hasGnuHash;
             int library_adjust;
             Object *object;
 
@@ -257,6 +258,10 @@ namespace Dyninst {
 
             void createHashSection(Elf_Word *&hashsecData, unsigned &hashsecSize, std::vector<Symbol *> &dynSymbols);
 
+            void createGnuHashSection(Elf_Word *&gnuHashData, unsigned &gnuHashSize, std::vector<Symbol *> &dynSymbols,
+                                      std::vector<Elf_Sym *> &dynElfSymbols,
+                                      dyn_hash_map<std::string, unsigned long> &dynSymNameMapping);
+
             void createDynamicSection(void *dynData, unsigned size, Elf_Dyn *&dynsecData, unsigned &dynsecSize,
                                       unsigned &dynSymbolNamesLength, std::vector<std::string> &dynStrs);
 